@@ -0,0 +1,517 @@
+#include "stdafx.h"
+#include <cold-md/bullet/min_dist_calculator.h>
+
+// Measures cold::bullet::min_dist_calculator<>::perform_distance_calculation on
+// procedurally generated scenes and prints one CSV line per configuration.
+//
+// Usage:
+// cold-md.bench [--meshes sphere,torus,box,soup] [--triangles 128,2048]
+//               [--objects 2,8,32] [--separations 0.01,0.5,2]
+//               [--repetitions 50] [--seed 42]
+//
+// Random values are taken from the raw std::mt19937 output, hence the same seed
+// gives the same scenes with every compiler and standard library.
+namespace bench {
+
+    const btScalar c_margin = 0.0001;
+
+    // Indexed triangle mesh centered at the origin. Owns the data the
+    // btTriangleIndexVertexArray refers to, hence it can't be copied.
+    struct mesh_data : boost::noncopyable {
+        std::vector<btScalar> vertices;
+        std::vector<int> triangles;
+        std::unique_ptr<btTriangleIndexVertexArray> index_vertex_array;
+
+        int add_vertex(btVector3 const& v_)
+        {
+            vertices.insert(vertices.end(), {v_.getX(), v_.getY(), v_.getZ()});
+            return (int)vertices.size() / 3 - 1;
+        }
+
+        void add_triangle(int a_, int b_, int c_)
+        {
+            triangles.insert(triangles.end(), {a_, b_, c_});
+        }
+
+        int num_triangles() const
+        {
+            return (int)triangles.size() / 3;
+        }
+
+        btScalar bounding_radius() const
+        {
+            btScalar r = 0;
+            for (auto v = 0u; v < vertices.size(); v += 3) {
+                r = std::max(r, btVector3(vertices[v], vertices[v + 1], vertices[v + 2]).length());
+            }
+            return r;
+        }
+
+        // must be called once after all vertices and triangles were added
+        btTriangleIndexVertexArray* finish()
+        {
+            if (triangles.empty()) {
+                throw std::logic_error("mesh has no triangles");
+            }
+
+            index_vertex_array = boost::make_unique<btTriangleIndexVertexArray>(
+                num_triangles(), &triangles[0], 3 * sizeof(int),
+                (int)vertices.size() / 3, &vertices[0], 3 * sizeof(btScalar));
+            return index_vertex_array.get();
+        }
+    };
+
+    // unit sphere, roughly num_triangles_ triangles
+    void tessellate_sphere(mesh_data& mesh_, int num_triangles_)
+    {
+        // 2 * segments * (rings - 1) triangles with segments = 2 * rings
+        auto const rings = std::max(3, (int)std::lround(std::sqrt(num_triangles_ / 4.) + 0.5));
+        auto const segments = 2 * rings;
+
+        auto const top = mesh_.add_vertex({0., 0., 1.});
+        for (auto i = 1; i < rings; ++i) {
+            auto const theta = SIMD_PI * i / rings;
+            for (auto j = 0; j < segments; ++j) {
+                auto const phi = SIMD_2_PI * j / segments;
+                mesh_.add_vertex({
+                    std::sin(theta) * std::cos(phi),
+                    std::sin(theta) * std::sin(phi),
+                    std::cos(theta)});
+            }
+        }
+        auto const bottom = mesh_.add_vertex({0., 0., -1.});
+
+        auto index = [&](int i_, int j_) { return 1 + (i_ - 1) * segments + j_ % segments; };
+
+        for (auto j = 0; j < segments; ++j) {
+            mesh_.add_triangle(top, index(1, j), index(1, j + 1));
+            for (auto i = 1; i < rings - 1; ++i) {
+                mesh_.add_triangle(index(i, j), index(i + 1, j), index(i, j + 1));
+                mesh_.add_triangle(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1));
+            }
+            mesh_.add_triangle(bottom, index(rings - 1, j + 1), index(rings - 1, j));
+        }
+    }
+
+    // torus with outer radius 1, roughly num_triangles_ triangles
+    void tessellate_torus(mesh_data& mesh_, int num_triangles_)
+    {
+        auto const major_radius = btScalar(0.7);
+        auto const minor_radius = btScalar(0.3);
+
+        // 2 * major_segments * minor_segments triangles with major_segments = 2 * minor_segments
+        auto const minor_segments = std::max(3, (int)std::lround(std::sqrt(num_triangles_ / 4.)));
+        auto const major_segments = 2 * minor_segments;
+
+        for (auto i = 0; i < major_segments; ++i) {
+            auto const phi = SIMD_2_PI * i / major_segments;
+            for (auto j = 0; j < minor_segments; ++j) {
+                auto const theta = SIMD_2_PI * j / minor_segments;
+                auto const r = major_radius + minor_radius * std::cos(theta);
+                mesh_.add_vertex({
+                    r * std::cos(phi),
+                    r * std::sin(phi),
+                    minor_radius * std::sin(theta)});
+            }
+        }
+
+        auto index = [&](int i_, int j_) {
+            return (i_ % major_segments) * minor_segments + j_ % minor_segments;
+        };
+
+        for (auto i = 0; i < major_segments; ++i) {
+            for (auto j = 0; j < minor_segments; ++j) {
+                mesh_.add_triangle(index(i, j), index(i + 1, j), index(i, j + 1));
+                mesh_.add_triangle(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1));
+            }
+        }
+    }
+
+    // cube with bounding sphere radius 1, each face is a k x k grid, roughly
+    // num_triangles_ triangles
+    void tessellate_box(mesh_data& mesh_, int num_triangles_)
+    {
+        // 6 faces * 2 * k * k triangles
+        auto const k = std::max(1, (int)std::lround(std::sqrt(num_triangles_ / 12.)));
+        auto const h = 1. / std::sqrt(3.);
+
+        for (auto axis = 0; axis < 3; ++axis) {
+            for (auto sign : {-1., +1.}) {
+                auto const first = (int)mesh_.vertices.size() / 3;
+
+                for (auto i = 0; i <= k; ++i) {
+                    for (auto j = 0; j <= k; ++j) {
+                        btVector3 v;
+                        v[axis] = btScalar(sign * h);
+                        v[(axis + 1) % 3] = btScalar(-h + 2. * h * i / k);
+                        v[(axis + 2) % 3] = btScalar(-h + 2. * h * j / k);
+                        mesh_.add_vertex(v);
+                    }
+                }
+
+                auto index = [&](int i_, int j_) { return first + i_ * (k + 1) + j_; };
+
+                for (auto i = 0; i < k; ++i) {
+                    for (auto j = 0; j < k; ++j) {
+                        mesh_.add_triangle(index(i, j), index(i + 1, j), index(i, j + 1));
+                        mesh_.add_triangle(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1));
+                    }
+                }
+            }
+        }
+    }
+
+    // Uniform value in [min_, max_) computed from the raw engine output. The
+    // std::mt19937 sequence is fixed by the standard, the output of
+    // std::uniform_real_distribution differs between standard libraries.
+    btScalar uniform(std::mt19937& rng_, btScalar min_, btScalar max_)
+    {
+        auto const u = std::uint32_t(rng_()) / 4294967296.;
+        return min_ + btScalar((max_ - min_) * u);
+    }
+
+    // One value per statement: the evaluation order of function arguments is
+    // unspecified, btVector3(uniform(...), uniform(...), ...) would differ
+    // between compilers.
+    btVector3 uniform_vector(std::mt19937& rng_, btScalar min_, btScalar max_)
+    {
+        auto const x = uniform(rng_, min_, max_);
+        auto const y = uniform(rng_, min_, max_);
+        auto const z = uniform(rng_, min_, max_);
+        return btVector3(x, y, z);
+    }
+
+    // num_triangles_ unconnected small triangles scattered in a ball of radius 0.8
+    void tessellate_soup(mesh_data& mesh_, int num_triangles_, std::mt19937& rng_)
+    {
+        for (auto t = 0; t < num_triangles_; ++t) {
+            btVector3 center;
+            do {
+                center = uniform_vector(rng_, -1., 1.);
+            } while (center.length2() > 1.);
+            center *= 0.8;
+
+            auto const offset_a = uniform_vector(rng_, -0.2, 0.2);
+            auto const offset_b = uniform_vector(rng_, -0.2, 0.2);
+            auto const offset_c = uniform_vector(rng_, -0.2, 0.2);
+
+            auto const a = mesh_.add_vertex(center + offset_a);
+            auto const b = mesh_.add_vertex(center + offset_b);
+            auto const c = mesh_.add_vertex(center + offset_c);
+            mesh_.add_triangle(a, b, c);
+        }
+    }
+
+    std::unique_ptr<mesh_data> make_mesh(std::string const& kind_, int num_triangles_, std::mt19937& rng_)
+    {
+        auto mesh = boost::make_unique<mesh_data>();
+
+        if (kind_ == "sphere") {
+            tessellate_sphere(*mesh, num_triangles_);
+        }
+        else if (kind_ == "torus") {
+            tessellate_torus(*mesh, num_triangles_);
+        }
+        else if (kind_ == "box") {
+            tessellate_box(*mesh, num_triangles_);
+        }
+        else if (kind_ == "soup") {
+            tessellate_soup(*mesh, num_triangles_, rng_);
+        }
+        else {
+            throw std::invalid_argument("unknown mesh kind: " + kind_);
+        }
+
+        mesh->finish();
+        return mesh;
+    }
+
+    // Engine for one configuration, seeded from everything that identifies it. A
+    // configuration always gets the same mesh and scene, no matter which other
+    // configurations are part of the sweep.
+    std::mt19937 make_rng(
+        unsigned seed_,
+        std::string const& kind_,
+        int num_triangles_,
+        int num_objects_ = 0,
+        btScalar separation_ = 0)
+    {
+        // FNV-1a, std::hash isn't guaranteed to be the same across implementations
+        std::uint32_t kind_hash = 2166136261u;
+        for (auto c : kind_) {
+            kind_hash = (kind_hash ^ (unsigned char)c) * 16777619u;
+        }
+
+        std::seed_seq seq = {
+            (std::uint32_t)seed_,
+            kind_hash,
+            (std::uint32_t)num_triangles_,
+            (std::uint32_t)num_objects_,
+            (std::uint32_t)std::lround(separation_ * 1e6)
+        };
+
+        return std::mt19937(seq);
+    }
+
+    // Collision world with num_objects_ randomly oriented instances of one mesh placed
+    // on a cubic grid. Bounding spheres of neighbours are exactly separation_ apart.
+    class scene : boost::noncopyable {
+        btDbvtBroadphase _col_broadphase;
+        btDefaultCollisionConfiguration _col_configuration;
+        btCollisionDispatcher _col_dispatcher = &_col_configuration;
+
+        btCollisionWorld _world = {
+            &_col_dispatcher,
+            &_col_broadphase,
+            &_col_configuration
+        };
+
+        // cant use in place stack allocated instances, see min_dist_fixture...
+        std::vector<std::unique_ptr<btGImpactMeshShape>> _shapes;
+        std::vector<std::unique_ptr<btCollisionObject>> _objects;
+    public:
+        scene(mesh_data& mesh_, int num_objects_, btScalar separation_, std::mt19937& rng_)
+        {
+            btGImpactCollisionAlgorithm::registerAlgorithm(&_col_dispatcher);
+
+            auto side = 1;
+            while (side * side * side < num_objects_) {
+                ++side;
+            }
+
+            auto const spacing = 2 * mesh_.bounding_radius() + separation_;
+
+            for (auto i = 0; i < num_objects_; ++i) {
+                _shapes.push_back(boost::make_unique<btGImpactMeshShape>(mesh_.index_vertex_array.get()));
+                _shapes.back()->setMargin(c_margin);
+                _shapes.back()->updateBound();
+
+                auto const angles = uniform_vector(rng_, -SIMD_PI, SIMD_PI);
+
+                _objects.push_back(boost::make_unique<btCollisionObject>());
+                _objects.back()->setCollisionShape(_shapes.back().get());
+                _objects.back()->setWorldTransform(btTransform(
+                    btQuaternion(angles.getX(), angles.getY(), angles.getZ()),
+                    spacing * btVector3(
+                        btScalar(i % side),
+                        btScalar((i / side) % side),
+                        btScalar(i / (side * side)))));
+
+                _world.addCollisionObject(_objects.back().get());
+            }
+        }
+
+        ~scene()
+        {
+            // objects go away before the world does...
+            for (auto& obj : _objects) {
+                _world.removeCollisionObject(obj.get());
+            }
+        }
+
+        btCollisionWorld* get()
+        {
+            return &_world;
+        }
+    };
+
+    struct statistics {
+        std::size_t num_entries = 0;
+        double min_ms = 0;
+        double p50_ms = 0;
+        double p90_ms = 0;
+        double p99_ms = 0;
+        double max_ms = 0;
+        double mean_ms = 0;
+    };
+
+    statistics measure(scene& scene_, int repetitions_)
+    {
+        statistics stats;
+
+        cold::bullet::min_dist_calculator<> calc(scene_.get());
+
+        // warm-up, fills bullet's internal caches and the pair cache
+        stats.num_entries = calc.perform_distance_calculation().size();
+
+        std::vector<double> durations;
+        durations.reserve(repetitions_);
+
+        for (auto r = 0; r < repetitions_; ++r) {
+            auto const start = std::chrono::steady_clock::now();
+            auto result_matrix = calc.perform_distance_calculation();
+            auto const stop = std::chrono::steady_clock::now();
+
+            durations.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+            stats.num_entries = result_matrix.size();
+        }
+
+        if (durations.empty()) {
+            return stats;
+        }
+
+        std::sort(durations.begin(), durations.end());
+
+        // nearest rank
+        auto percentile = [&](double p_) {
+            auto const rank = (std::size_t)std::ceil(p_ * durations.size());
+            return durations[std::min(durations.size(), std::max<std::size_t>(rank, 1)) - 1];
+        };
+
+        stats.min_ms = durations.front();
+        stats.p50_ms = percentile(0.50);
+        stats.p90_ms = percentile(0.90);
+        stats.p99_ms = percentile(0.99);
+        stats.max_ms = durations.back();
+        stats.mean_ms = std::accumulate(durations.begin(), durations.end(), 0.) / durations.size();
+
+        return stats;
+    }
+
+    struct options {
+        std::vector<std::string> meshes = {"sphere", "torus", "box", "soup"};
+        std::vector<int> triangles = {128, 2048};
+        std::vector<int> objects = {2, 8, 32};
+        std::vector<btScalar> separations = {btScalar(0.01), btScalar(0.5), btScalar(2.)};
+        int repetitions = 50;
+        unsigned seed = 42;
+    };
+
+    template <typename T>
+    std::vector<T> parse_list(std::string const& name_, std::string const& value_)
+    {
+        std::vector<T> list;
+        std::istringstream items(value_);
+        std::string item;
+
+        while (std::getline(items, item, ',')) {
+            std::istringstream in(item);
+            T t;
+            if (!(in >> t) || !in.eof()) {
+                throw std::invalid_argument("invalid value for " + name_ + ": " + item);
+            }
+            list.push_back(t);
+        }
+
+        if (list.empty()) {
+            throw std::invalid_argument("empty list for " + name_);
+        }
+
+        return list;
+    }
+
+    // options which take exactly one value
+    template <typename T>
+    T parse_value(std::string const& name_, std::string const& value_)
+    {
+        auto const list = parse_list<T>(name_, value_);
+
+        if (list.size() != 1) {
+            throw std::invalid_argument(name_ + " takes a single value: " + value_);
+        }
+
+        return list.front();
+    }
+
+    template <typename T>
+    std::vector<T> require_positive(std::string const& name_, std::vector<T> const& list_)
+    {
+        for (auto const& t : list_) {
+            if (t <= 0) {
+                throw std::invalid_argument(name_ + " must be positive");
+            }
+        }
+
+        return list_;
+    }
+
+    options parse_options(int argc_, char* argv_[])
+    {
+        options opts;
+
+        for (auto i = 1; i < argc_; i += 2) {
+            std::string const name = argv_[i];
+
+            if (i + 1 == argc_) {
+                throw std::invalid_argument("missing value for " + name);
+            }
+
+            std::string const value = argv_[i + 1];
+
+            if (name == "--meshes") {
+                opts.meshes = parse_list<std::string>(name, value);
+            }
+            else if (name == "--triangles") {
+                opts.triangles = require_positive(name, parse_list<int>(name, value));
+            }
+            else if (name == "--objects") {
+                opts.objects = require_positive(name, parse_list<int>(name, value));
+            }
+            else if (name == "--separations") {
+                opts.separations = parse_list<btScalar>(name, value);
+            }
+            else if (name == "--repetitions") {
+                opts.repetitions = parse_value<int>(name, value);
+                if (opts.repetitions <= 0) {
+                    throw std::invalid_argument(name + " must be positive");
+                }
+            }
+            else if (name == "--seed") {
+                opts.seed = parse_value<unsigned>(name, value);
+            }
+            else {
+                throw std::invalid_argument("unknown option: " + name);
+            }
+        }
+
+        return opts;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        auto const opts = bench::parse_options(argc, argv);
+
+        std::cout
+            << "mesh,triangles,objects,separation,pairs,repetitions,"
+            << "min_ms,p50_ms,p90_ms,p99_ms,max_ms,pairs_per_s" << std::endl;
+
+        for (auto const& kind : opts.meshes) {
+            for (auto num_triangles : opts.triangles) {
+                auto mesh_rng = bench::make_rng(opts.seed, kind, num_triangles);
+                auto mesh = bench::make_mesh(kind, num_triangles, mesh_rng);
+
+                for (auto num_objects : opts.objects) {
+                    for (auto separation : opts.separations) {
+                        // same seed, same scenes: runs of different builds are comparable
+                        auto scene_rng = bench::make_rng(opts.seed, kind, num_triangles, num_objects, separation);
+                        bench::scene scene(*mesh, num_objects, separation, scene_rng);
+                        auto const stats = bench::measure(scene, opts.repetitions);
+
+                        std::cout
+                            << kind << ','
+                            << mesh->num_triangles() << ','
+                            << num_objects << ','
+                            << separation << ','
+                            << stats.num_entries << ','
+                            << opts.repetitions << ','
+                            << stats.min_ms << ','
+                            << stats.p50_ms << ','
+                            << stats.p90_ms << ','
+                            << stats.p99_ms << ','
+                            << stats.max_ms << ','
+                            << (stats.mean_ms > 0 ? 1000. * stats.num_entries / stats.mean_ms : 0.)
+                            << std::endl;
+                    }
+                }
+            }
+        }
+    }
+    catch (std::exception const& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+// Keep this header free of platform specific includes, the benchmark is
+// supposed to build on Linux as well. Otherwise the same set as the one of
+// the boost tests, min_dist_calculator.h relies on it.
+#include <btBulletCollisionCommon.h>
+#include <btBulletDynamicsCommon.h>
+#include <BulletCollision/Gimpact/btGImpactCollisionAlgorithm.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
+#include <BulletCollision/NarrowPhaseCollision/btConvexPenetrationDepthSolver.h>
+#include <BulletCollision/NarrowPhaseCollision/btPointCollector.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scope_exit.hpp>
+#include <boost/make_unique.hpp>
+
+#include <limits>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stack>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+#include <cstddef>
+#include <cfloat>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
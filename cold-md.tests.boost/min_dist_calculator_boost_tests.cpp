@@ -100,6 +100,26 @@ namespace tests {
             }
         };
 
+        // Checks that act_ holds the same entries as exp_ in the same order. The
+        // points are not compared, they aren't unique for parallel edges or faces.
+        template <typename ResultMatrix>
+        void check_result_matrices_equal(ResultMatrix const& exp_, ResultMatrix const& act_)
+        {
+            BOOST_REQUIRE_EQUAL(exp_.size(), act_.size());
+
+            for (auto i = 0u; i < act_.size(); ++i) {
+                auto const& act = act_[i];
+                auto const& exp = exp_[i];
+
+                BOOST_TEST_MESSAGE(act);
+
+                BOOST_REQUIRE(act.obj_a == exp.obj_a);
+                BOOST_REQUIRE(act.obj_b == exp.obj_b);
+                BOOST_CHECK(exp.kind == act.kind);
+                BOOST_CHECK(std::abs(exp.distance - act.distance) < c_precision);
+            }
+        }
+
         BOOST_AUTO_TEST_SUITE(min_dist_calculator_basic_tests);
 
         // The position of the objects does not matter; the value of distance is always (close to) zero
@@ -370,6 +390,122 @@ namespace tests {
                     act.point_on_b.getY() < (-1. + c_precision));
             }
         }
+
+        // define position p4: n squares in a row along the x axis, each one
+        // translated by 3 units with respect to its predecessor
+        // => the gap between squares i < j is 3 * (j - i) - 2, no collisions at all
+        BOOST_AUTO_TEST_CASE(result_matrix_of_n_squares_is_ordered_row_by_row_as_upper_triangle)
+        {
+            auto const step = 3.;
+
+            ///@ Given a collision world with non-colliding four mesh objects a, b, c, d in position p4...
+            min_dist_fixture fixture = {
+               btTransform({0., 0., 0.}, {0. * step, 0., 0.}), // a
+               btTransform({0., 0., 0.}, {1. * step, 0., 0.}), // b
+               btTransform({0., 0., 0.}, {2. * step, 0., 0.}), // c
+               btTransform({0., 0., 0.}, {3. * step, 0., 0.})  // d
+            };
+
+            //@ When I perform_distance_calculation the minimimum distances in this world...
+            cold::bullet::min_dist_calculator<> calc(fixture.world.get());
+            auto act_result_matrix = calc.perform_distance_calculation();
+
+            ///@ Then the number of results in the output matrix is n * (n - 1) / 2 = 6
+            auto const n = fixture.objects.size();
+            BOOST_REQUIRE_EQUAL(n * (n - 1) / 2, act_result_matrix.size());
+
+            ///@ And the entries are ordered (a, b), (a, c), (a, d), (b, c), (b, d), (c, d)
+            ///@ regardless of how the calculator evaluates the pairs internally
+            auto act = act_result_matrix.begin();
+            for (auto i = 0u; i < n; ++i) {
+                for (auto j = i + 1; j < n; ++j, ++act) {
+                    BOOST_TEST_MESSAGE(*act);
+
+                    BOOST_REQUIRE(act->obj_a == fixture.objects[i].get());
+                    BOOST_REQUIRE(act->obj_b == fixture.objects[j].get());
+
+                    BOOST_CHECK(cold::bullet::output_kind::free == act->kind);
+
+                    ///@ - distance of entry (i, j) is close to the gap between i and j
+                    auto const exp_dist = step * (j - i) - 2.;
+                    BOOST_CHECK(
+                        (exp_dist - c_precision) <= act->distance &&
+                        act->distance <= (exp_dist + c_precision));
+                }
+            }
+        }
+
+        // define position p2 moving: b starts in position p2 and is moved away from a
+        // in tiny steps along the z axis, like a slowly moving part of a robot would
+        BOOST_AUTO_TEST_CASE(repeated_calculations_on_slowly_moving_squares_match_fresh_calculations)
+        {
+            auto const step = 0.01;
+
+            ///@ Given a collision world with non-colliding two mesh objects a, b in position p2...
+            min_dist_fixture fixture = {
+               btTransform({0., 0., 0.},{0., 0., +0.5}), // a
+               btTransform({0., 0., 0.},{0., 0., -0.5})  // b
+            };
+
+            ///@ And a calculator which is kept alive across all calculations
+            cold::bullet::min_dist_calculator<> calc(fixture.world.get());
+
+            for (auto k = 0; k < 10; ++k) {
+                ///@ When I move b by k steps and perform_distance_calculation again...
+                fixture.objects[1]->getWorldTransform().setOrigin({0., 0., -0.5 - k * step});
+                auto act_result_matrix = calc.perform_distance_calculation();
+
+                ///@ Then the result equals the one of a freshly constructed calculator
+                cold::bullet::min_dist_calculator<> fresh_calc(fixture.world.get());
+                auto exp_result_matrix = fresh_calc.perform_distance_calculation();
+
+                check_result_matrices_equal(exp_result_matrix, act_result_matrix);
+
+                ///@ And the distance follows the motion of b
+                BOOST_REQUIRE_EQUAL(1u, act_result_matrix.size());
+                auto const& act = act_result_matrix.front();
+                auto const exp_dist = 1. + k * step;
+                BOOST_CHECK(
+                    (exp_dist - c_precision) <= act.distance &&
+                    act.distance <= (exp_dist + c_precision));
+            }
+        }
+
+        // define position p3 with moving c: a and b stay in position p3, only c is
+        // translated along the x axis away from a and b
+        BOOST_AUTO_TEST_CASE(moving_one_of_three_squares_yields_same_result_matrix_as_full_recalculation)
+        {
+            ///@ Given a collision world with non-colliding three mesh objects a, b, c in position p3...
+            min_dist_fixture fixture = {
+               btTransform({0., 0., 0.}, {0., 0., 0.}),   // a
+               btTransform({0., 0., 0.}, {0., -2.5, 0.}), // b
+               btTransform({SIMD_HALF_PI, 0., 0.}, { 2., 0., 0.}) // c
+            };
+
+            ///@ And a calculator which has already performed one calculation
+            cold::bullet::min_dist_calculator<> calc(fixture.world.get());
+            auto const initial_result_matrix = calc.perform_distance_calculation();
+            BOOST_REQUIRE_EQUAL(3u, initial_result_matrix.size());
+
+            ///@ When I move c only and perform_distance_calculation again...
+            fixture.objects[2]->getWorldTransform().setOrigin({3., 0., 0.});
+            auto act_result_matrix = calc.perform_distance_calculation();
+
+            ///@ Then the result matrix equals the one of a full recalculation
+            cold::bullet::min_dist_calculator<> fresh_calc(fixture.world.get());
+            auto exp_result_matrix = fresh_calc.perform_distance_calculation();
+
+            check_result_matrices_equal(exp_result_matrix, act_result_matrix);
+
+            ///@ And the entry d(a, b) of the static pair did not change
+            BOOST_CHECK(std::abs(initial_result_matrix[0].distance - act_result_matrix[0].distance) < c_precision);
+
+            ///@ And the entry d(a, c) follows the motion of c
+            BOOST_CHECK(
+                (2. - c_precision) <= act_result_matrix[1].distance &&
+                act_result_matrix[1].distance <= (2. + c_precision));
+        }
+
         // etc...
 
         BOOST_AUTO_TEST_SUITE_END();
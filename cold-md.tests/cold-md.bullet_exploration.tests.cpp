@@ -385,6 +385,61 @@ namespace tests {
                 }
             }
 
+            TEST_METHOD(bullet_world_skips_pairs_excluded_by_collision_filter_groups)
+            {
+                test_objects t_objs(0.01);
+                {
+                    auto t_world = std::make_unique<bullet_world_for_test>(t_objs);
+                    Assert::IsTrue(!!t_world);
+
+                    auto t_col_world = t_world->get_world();
+                    auto t_obj_b = t_objs.objects[1].get();
+
+                    // move b such that the AABBs of a and b overlap:
+                    t_obj_b->getWorldTransform().setOrigin(btVector3(1., 1., 0));
+
+                    t_col_world->performDiscreteCollisionDetection();
+                    Assert::AreEqual(1, t_col_world->getPairCache()->getNumOverlappingPairs());
+
+                    // a is in the default group, b's mask excludes the default group:
+                    auto const t_mask_without_default = short(
+                        btBroadphaseProxy::AllFilter ^ btBroadphaseProxy::DefaultFilter);
+
+                    // 1. filter at insertion, the pair is never created:
+                    t_col_world->removeCollisionObject(t_obj_b);
+                    t_col_world->addCollisionObject(t_obj_b,
+                        btBroadphaseProxy::CharacterFilter, t_mask_without_default);
+
+                    t_col_world->performDiscreteCollisionDetection();
+                    Assert::AreEqual(0, t_col_world->getPairCache()->getNumOverlappingPairs());
+
+                    // 2. change the filter at runtime; first restore b's default filter
+                    // by adding it again, so that the pair exists:
+                    t_col_world->removeCollisionObject(t_obj_b);
+                    t_col_world->addCollisionObject(t_obj_b);
+
+                    t_col_world->performDiscreteCollisionDetection();
+                    Assert::AreEqual(1, t_col_world->getPairCache()->getNumOverlappingPairs());
+
+                    // now change the mask of b in place, without removing the object:
+                    t_obj_b->getBroadphaseHandle()->m_collisionFilterMask = t_mask_without_default;
+
+                    // the filter is consulted when a pair is added only, hence an
+                    // existing pair outlives the change of the mask...
+                    t_col_world->performDiscreteCollisionDetection();
+                    Assert::AreEqual(1, t_col_world->getPairCache()->getNumOverlappingPairs());
+
+                    // ...unless the pairs of the proxy are removed explicitly. Note that
+                    // cleanProxyFromPairs() is not enough, it only frees the collision
+                    // algorithms of the pairs and leaves the pairs in the cache:
+                    t_col_world->getPairCache()->removeOverlappingPairsContainingProxy(
+                        t_obj_b->getBroadphaseHandle(), t_col_world->getDispatcher());
+
+                    t_col_world->performDiscreteCollisionDetection();
+                    Assert::AreEqual(0, t_col_world->getPairCache()->getNumOverlappingPairs());
+                }
+            }
+
             class test_nearphase_callback : public test_callback_base {
                 static test_nearphase_callback* s_this;
             public:
@@ -25,6 +25,31 @@ namespace tests {
             (int)c_unit_square_tri.size() / 3u, &c_unit_square_tri[0], 3 * sizeof(int),
             (int)c_unit_square_ver.size() / 3u, &c_unit_square_ver[0], 3 * sizeof(btScalar));
 
+        // four unit squares in a row along the x axis, x in <-4, +4>
+        std::array<btScalar, 10 * 3> c_strip_ver = {
+            -4, -1, 0,
+            -2, -1, 0,
+             0, -1, 0,
+            +2, -1, 0,
+            +4, -1, 0,
+            -4, +1, 0,
+            -2, +1, 0,
+             0, +1, 0,
+            +2, +1, 0,
+            +4, +1, 0
+        };
+
+        std::array<int, 8 * 3> c_strip_tri = {
+            0, 1, 6,  6, 5, 0,
+            1, 2, 7,  7, 6, 1,
+            2, 3, 8,  8, 7, 2,
+            3, 4, 9,  9, 8, 3
+        };
+
+        btTriangleIndexVertexArray c_strip_data(
+            (int)c_strip_tri.size() / 3u, &c_strip_tri[0], 3 * sizeof(int),
+            (int)c_strip_ver.size() / 3u, &c_strip_ver[0], 3 * sizeof(btScalar));
+
         class test_objects {
         public:
             std::unique_ptr<btGImpactMeshShape> shapes[2];
@@ -425,6 +450,593 @@ namespace tests {
                 traverse(shape.get());
             }
 
+            // Lower bound of the distance between anything contained in the boxes
+            // a_ and b_; zero if the boxes overlap.
+            static btScalar aabb_distance_lower_bound(btAABB const& a_, btAABB const& b_)
+            {
+                btVector3 gap;
+                for (auto k = 0; k < 3; ++k) {
+                    gap[k] = std::max(btScalar(0), std::max(
+                        a_.m_min[k] - b_.m_max[k],
+                        b_.m_min[k] - a_.m_max[k]));
+                }
+                return gap.length();
+            }
+
+            // Distance between two convex shapes computed by GJK, negative values indicate
+            // penetration. GJK subtracts the margins of both shapes from the distance, use
+            // shapes with zero margin for exact results. Returns false if GJK/EPA gave up,
+            // the outputs aren't set then.
+            static bool convex_distance(
+                btConvexShape const& a_, btTransform const& transf_a_,
+                btConvexShape const& b_, btTransform const& transf_b_,
+                btScalar& distance_,
+                btVector3& point_on_a_,
+                btVector3& point_on_b_)
+            {
+                btVoronoiSimplexSolver simplex_solver;
+                btGjkEpaPenetrationDepthSolver penetration_solver;
+                btGjkPairDetector detector(&a_, &b_, &simplex_solver, &penetration_solver);
+
+                btGjkPairDetector::ClosestPointInput input;
+                input.m_transformA = transf_a_;
+                input.m_transformB = transf_b_;
+
+                btPointCollector output;
+                detector.getClosestPoints(input, output, nullptr);
+
+                if (!output.m_hasResult) {
+                    return false;
+                }
+
+                // the collector reports the point on b and the normal pointing from b to a
+                distance_ = output.m_distance;
+                point_on_b_ = output.m_pointInWorld;
+                point_on_a_ = output.m_pointInWorld + output.m_normalOnBInWorld * output.m_distance;
+
+                return true;
+            }
+
+            // Closest points c1_, c2_ of the segments [p1_, q1_] and [p2_, q2_],
+            // returns their distance (Ericson, Real-Time Collision Detection, 5.1.9).
+            static btScalar segment_segment_distance(
+                btVector3 const& p1_, btVector3 const& q1_,
+                btVector3 const& p2_, btVector3 const& q2_,
+                btVector3& c1_,
+                btVector3& c2_)
+            {
+                auto const d1 = q1_ - p1_;
+                auto const d2 = q2_ - p2_;
+                auto const r = p1_ - p2_;
+                auto const a = d1.length2();
+                auto const e = d2.length2();
+                auto const f = d2.dot(r);
+
+                btScalar s = 0, t = 0;
+                if (a <= SIMD_EPSILON && e <= SIMD_EPSILON) {
+                    // both segments degenerate into points
+                }
+                else if (a <= SIMD_EPSILON) {
+                    t = btClamped(f / e, btScalar(0), btScalar(1));
+                }
+                else {
+                    auto const c = d1.dot(r);
+                    if (e <= SIMD_EPSILON) {
+                        s = btClamped(-c / a, btScalar(0), btScalar(1));
+                    }
+                    else {
+                        auto const b = d1.dot(d2);
+                        auto const denom = a * e - b * b;
+                        // parallel segments have no unique pair, any s will do then
+                        s = denom > SIMD_EPSILON
+                            ? btClamped((b * f - c * e) / denom, btScalar(0), btScalar(1))
+                            : btScalar(0);
+                        t = (b * s + f) / e;
+                        if (t < 0) {
+                            t = 0;
+                            s = btClamped(-c / a, btScalar(0), btScalar(1));
+                        }
+                        else if (t > 1) {
+                            t = 1;
+                            s = btClamped((b - c) / a, btScalar(0), btScalar(1));
+                        }
+                    }
+                }
+
+                c1_ = p1_ + d1 * s;
+                c2_ = p2_ + d2 * t;
+                return c1_.distance(c2_);
+            }
+
+            // Point of the triangle t_ closest to p_ (Ericson, Real-Time Collision
+            // Detection, 5.1.5).
+            static btVector3 closest_point_on_triangle(btVector3 const& p_, btPrimitiveTriangle const& t_)
+            {
+                auto const& a = t_.m_vertices[0];
+                auto const& b = t_.m_vertices[1];
+                auto const& c = t_.m_vertices[2];
+                auto const ab = b - a;
+                auto const ac = c - a;
+
+                auto const ap = p_ - a;
+                auto const d1 = ab.dot(ap);
+                auto const d2 = ac.dot(ap);
+                if (d1 <= 0 && d2 <= 0) {
+                    return a;
+                }
+
+                auto const bp = p_ - b;
+                auto const d3 = ab.dot(bp);
+                auto const d4 = ac.dot(bp);
+                if (d3 >= 0 && d4 <= d3) {
+                    return b;
+                }
+
+                auto const vc = d1 * d4 - d3 * d2;
+                if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+                    return a + ab * (d1 / (d1 - d3));
+                }
+
+                auto const cp = p_ - c;
+                auto const d5 = ab.dot(cp);
+                auto const d6 = ac.dot(cp);
+                if (d6 >= 0 && d5 <= d6) {
+                    return c;
+                }
+
+                auto const vb = d5 * d2 - d1 * d6;
+                if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+                    return a + ac * (d2 / (d2 - d6));
+                }
+
+                auto const va = d3 * d6 - d5 * d4;
+                if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+                    return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+                }
+
+                auto const denom = 1 / (va + vb + vc);
+                return a + ab * (vb * denom) + ac * (vc * denom);
+            }
+
+            // True if the segment [p_, q_] passes through the interior of the
+            // plane of t_ inside t_, x_ is the crossing point then. Segments
+            // merely touching the plane are left to the point-triangle distances.
+            static bool segment_crosses_triangle(
+                btVector3 const& p_, btVector3 const& q_,
+                btPrimitiveTriangle const& t_,
+                btVector3& x_)
+            {
+                auto const normal = (t_.m_vertices[1] - t_.m_vertices[0]).cross(t_.m_vertices[2] - t_.m_vertices[0]);
+                auto const dist_p = normal.dot(p_ - t_.m_vertices[0]);
+                auto const dist_q = normal.dot(q_ - t_.m_vertices[0]);
+
+                if (!((dist_p < 0 && dist_q > 0) || (dist_p > 0 && dist_q < 0))) {
+                    return false;
+                }
+
+                x_ = p_ + (q_ - p_) * (dist_p / (dist_p - dist_q));
+                return closest_point_on_triangle(x_, t_).distance2(x_) <= SIMD_EPSILON;
+            }
+
+            // Exact distance between two triangles from their features: an edge
+            // crossing the other triangle means contact, otherwise the minimum is
+            // taken on an edge pair or a vertex and the opposite triangle.
+            static btScalar triangle_feature_distance(
+                btPrimitiveTriangle const& a_,
+                btPrimitiveTriangle const& b_,
+                btVector3& point_on_a_,
+                btVector3& point_on_b_)
+            {
+                btVector3 x;
+                for (auto i = 0; i < 3; ++i) {
+                    auto const& p = a_.m_vertices[i];
+                    auto const& q = a_.m_vertices[(i + 1) % 3];
+                    if (segment_crosses_triangle(p, q, b_, x)) {
+                        point_on_a_ = x;
+                        point_on_b_ = x;
+                        return 0;
+                    }
+                }
+
+                for (auto i = 0; i < 3; ++i) {
+                    auto const& p = b_.m_vertices[i];
+                    auto const& q = b_.m_vertices[(i + 1) % 3];
+                    if (segment_crosses_triangle(p, q, a_, x)) {
+                        point_on_a_ = x;
+                        point_on_b_ = x;
+                        return 0;
+                    }
+                }
+
+                auto distance = BT_LARGE_FLOAT;
+
+                for (auto i = 0; i < 3; ++i) {
+                    for (auto j = 0; j < 3; ++j) {
+                        btVector3 c_a, c_b;
+                        auto const d = segment_segment_distance(
+                            a_.m_vertices[i], a_.m_vertices[(i + 1) % 3],
+                            b_.m_vertices[j], b_.m_vertices[(j + 1) % 3],
+                            c_a, c_b);
+                        if (d < distance) {
+                            distance = d;
+                            point_on_a_ = c_a;
+                            point_on_b_ = c_b;
+                        }
+                    }
+                }
+
+                for (auto const& v_a : a_.m_vertices) {
+                    auto const c_b = closest_point_on_triangle(v_a, b_);
+                    if (v_a.distance(c_b) < distance) {
+                        distance = v_a.distance(c_b);
+                        point_on_a_ = v_a;
+                        point_on_b_ = c_b;
+                    }
+                }
+
+                for (auto const& v_b : b_.m_vertices) {
+                    auto const c_a = closest_point_on_triangle(v_b, a_);
+                    if (v_b.distance(c_a) < distance) {
+                        distance = v_b.distance(c_a);
+                        point_on_a_ = c_a;
+                        point_on_b_ = v_b;
+                    }
+                }
+
+                return distance;
+            }
+
+            // Distance between two triangles given in world coordinates, never negative.
+            // Separated triangles are handled by GJK. Touching or intersecting triangles
+            // yield 0 and one contact point shared by both outputs, EPA's penetration
+            // witnesses are useless for a distance.
+            static btScalar triangle_distance(
+                btPrimitiveTriangle const& a_,
+                btPrimitiveTriangle const& b_,
+                btVector3& point_on_a_,
+                btVector3& point_on_b_)
+            {
+                btTriangleShape shape_a(a_.m_vertices[0], a_.m_vertices[1], a_.m_vertices[2]);
+                btTriangleShape shape_b(b_.m_vertices[0], b_.m_vertices[1], b_.m_vertices[2]);
+                shape_a.setMargin(0);
+                shape_b.setMargin(0);
+
+                btScalar distance;
+                btTransform identity;
+                identity.setIdentity();
+
+                if (convex_distance(shape_a, identity, shape_b, identity, distance, point_on_a_, point_on_b_)
+                    && distance > 0) {
+                    return distance;
+                }
+
+                // GJK either reported a penetration or, as it frequently does for flat
+                // triangles with zero margins, gave up. Compute the distance exactly
+                // from the edges and vertices instead:
+                return triangle_feature_distance(a_, b_, point_on_a_, point_on_b_);
+            }
+
+            struct box_tree_min_dist {
+                btScalar distance = BT_LARGE_FLOAT;
+                btVector3 point_on_a;
+                btVector3 point_on_b;
+                int num_node_pairs = 0;
+                int num_triangle_pairs = 0;
+            };
+
+            static btAABB node_bound(btGImpactBoxSet const* box_set_, int node_, btTransform const& transf_)
+            {
+                btAABB b;
+                box_set_->getNodeBound(node_, b);
+                b.appy_transform(transf_);
+                return b;
+            }
+
+            struct box_tree_node_pair {
+                int first;
+                int second;
+                btScalar lower_bound;
+                // squared diagonals of both boxes, decide which one is split
+                btScalar extent2_first;
+                btScalar extent2_second;
+            };
+
+            // Dual tree branch and bound: descends both box trees simultaneously and
+            // drops every node pair whose box distance cannot improve the best
+            // triangle distance found so far. The larger box is split first and the
+            // nearer of both child pairs is visited first, so that the best distance
+            // drops early.
+            void min_dist_traverse_box_trees(
+                btGImpactBoxSet const* box_set_a_, btTransform const& transf_a_,
+                btGImpactBoxSet const* box_set_b_, btTransform const& transf_b_,
+                box_tree_min_dist& result_)
+            {
+                std::stack<box_tree_node_pair> stack;
+
+                auto make_node_pair = [&](int node_a_, int node_b_) {
+                    auto const a = node_bound(box_set_a_, node_a_, transf_a_);
+                    auto const b = node_bound(box_set_b_, node_b_, transf_b_);
+                    return box_tree_node_pair{node_a_, node_b_,
+                        aabb_distance_lower_bound(a, b),
+                        (a.m_max - a.m_min).length2(),
+                        (b.m_max - b.m_min).length2()};
+                };
+
+                // the farther pair goes to the stack first, hence it's popped last
+                auto push_nearer_last = [&](box_tree_node_pair const& p_, box_tree_node_pair const& q_) {
+                    if (p_.lower_bound < q_.lower_bound) {
+                        stack.push(q_);
+                        stack.push(p_);
+                    }
+                    else {
+                        stack.push(p_);
+                        stack.push(q_);
+                    }
+                };
+
+                stack.push(make_node_pair(0, 0));
+
+                while (!stack.empty()) {
+                    auto node_pair = stack.top();
+                    stack.pop();
+
+                    ++result_.num_node_pairs;
+
+                    if (node_pair.lower_bound >= result_.distance) {
+                        continue;
+                    }
+
+                    auto const leaf_a = box_set_a_->isLeafNode(node_pair.first);
+                    auto const leaf_b = box_set_b_->isLeafNode(node_pair.second);
+
+                    if (leaf_a && leaf_b) {
+                        btPrimitiveTriangle t_a, t_b;
+                        box_set_a_->getNodeTriangle(node_pair.first, t_a);
+                        box_set_b_->getNodeTriangle(node_pair.second, t_b);
+                        t_a.applyTransform(transf_a_);
+                        t_b.applyTransform(transf_b_);
+
+                        ++result_.num_triangle_pairs;
+
+                        btVector3 point_on_a, point_on_b;
+                        auto const d = triangle_distance(t_a, t_b, point_on_a, point_on_b);
+
+                        if (d < result_.distance) {
+                            result_.distance = d;
+                            result_.point_on_a = point_on_a;
+                            result_.point_on_b = point_on_b;
+                        }
+                    }
+                    else if (leaf_b || (!leaf_a && node_pair.extent2_first >= node_pair.extent2_second)) {
+                        push_nearer_last(
+                            make_node_pair(box_set_a_->getLeftNode(node_pair.first), node_pair.second),
+                            make_node_pair(box_set_a_->getRightNode(node_pair.first), node_pair.second));
+                    }
+                    else {
+                        push_nearer_last(
+                            make_node_pair(node_pair.first, box_set_b_->getLeftNode(node_pair.second)),
+                            make_node_pair(node_pair.first, box_set_b_->getRightNode(node_pair.second)));
+                    }
+                }
+            }
+
+            void min_dist_traverse(
+                btGImpactMeshShape* mesh_shape_a_, btTransform const& transf_a_,
+                btGImpactMeshShape* mesh_shape_b_, btTransform const& transf_b_,
+                box_tree_min_dist& result_)
+            {
+                for (auto mp_index_a = 0; mp_index_a < mesh_shape_a_->getMeshPartCount(); ++mp_index_a) {
+                    auto mesh_part_a = mesh_shape_a_->getMeshPart(mp_index_a);
+
+                    mesh_part_a->lockChildShapes();
+
+                    BOOST_SCOPE_EXIT(mesh_part_a)
+                    {
+                        mesh_part_a->unlockChildShapes();
+                    } BOOST_SCOPE_EXIT_END;
+
+                    for (auto mp_index_b = 0; mp_index_b < mesh_shape_b_->getMeshPartCount(); ++mp_index_b) {
+                        auto mesh_part_b = mesh_shape_b_->getMeshPart(mp_index_b);
+
+                        mesh_part_b->lockChildShapes();
+
+                        BOOST_SCOPE_EXIT(mesh_part_b)
+                        {
+                            mesh_part_b->unlockChildShapes();
+                        } BOOST_SCOPE_EXIT_END;
+
+                        min_dist_traverse_box_trees(
+                            mesh_part_a->getBoxSet(), transf_a_,
+                            mesh_part_b->getBoxSet(), transf_b_,
+                            result_);
+                    }
+                }
+            }
+
+            TEST_METHOD(can_find_min_dist_of_gimpact_mesh_shapes_by_dual_box_tree_traversal)
+            {
+                auto shape_a = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_a->setMargin(c_margin);
+                shape_a->updateBound();
+
+                auto shape_b = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_b->setMargin(c_margin);
+                shape_b->updateBound();
+
+                // two parallel squares, b is shifted diagonally such that only the
+                // corners (+1, +1) of a and (-1, -1) of b are close to each other:
+                btTransform transf_a(btQuaternion(0, 0, 0), btVector3(0, 0, +0.5));
+                btTransform transf_b(btQuaternion(0, 0, 0), btVector3(2, 2, -0.5));
+
+                box_tree_min_dist result;
+                min_dist_traverse(shape_a.get(), transf_a, shape_b.get(), transf_b, result);
+
+                Logger::WriteMessage(mstest_utils::wlog_message()
+                    << "distance: " << result.distance << std::endl
+                    << "node pairs: " << result.num_node_pairs << std::endl
+                    << "triangle pairs: " << result.num_triangle_pairs << endl);
+
+                Assert::IsTrue(std::abs(result.distance - 1.) < c_margin);
+                Assert::IsTrue(btVector3(+1, +1, +0.5).distance(result.point_on_a) < c_margin);
+                Assert::IsTrue(btVector3(+1, +1, -0.5).distance(result.point_on_b) < c_margin);
+            }
+
+            TEST_METHOD(dual_box_tree_traversal_prunes_distant_triangle_pairs)
+            {
+                auto shape_a = std::make_unique<btGImpactMeshShape>(&c_strip_data);
+                shape_a->setMargin(c_margin);
+                shape_a->updateBound();
+
+                auto shape_b = std::make_unique<btGImpactMeshShape>(&c_strip_data);
+                shape_b->setMargin(c_margin);
+                shape_b->updateBound();
+
+                // two strips in a row, the right end x = 4 of a and the left end
+                // x = 5 of b are close to each other, everything else is far away:
+                btTransform transf_a(btQuaternion(0, 0, 0), btVector3(0, 0, 0));
+                btTransform transf_b(btQuaternion(0, 0, 0), btVector3(9, 0, 0));
+
+                box_tree_min_dist result;
+                min_dist_traverse(shape_a.get(), transf_a, shape_b.get(), transf_b, result);
+
+                Logger::WriteMessage(mstest_utils::wlog_message()
+                    << "distance: " << result.distance << std::endl
+                    << "node pairs: " << result.num_node_pairs << std::endl
+                    << "triangle pairs: " << result.num_triangle_pairs << endl);
+
+                Assert::IsTrue(std::abs(result.distance - 1.) < c_margin);
+                Assert::IsTrue(std::abs(result.point_on_a.getX() - 4.) < c_margin);
+                Assert::IsTrue(std::abs(result.point_on_b.getX() - 5.) < c_margin);
+
+                // only the two triangles of a's right square and the two of b's left
+                // square are within the bound, 2 x 2 triangle pairs plus some room
+                // for the shape of the trees; an exhaustive search tests 8 x 8:
+                Assert::IsTrue(result.num_triangle_pairs <= 8);
+            }
+
+            TEST_METHOD(triangle_feature_distance_finds_edge_to_edge_distance)
+            {
+                // a lies in the xz plane, b in the yz plane, their edges along the x
+                // and the y axis are 1 apart while the nearest vertices are sqrt(3) apart:
+                btPrimitiveTriangle a, b;
+                a.m_vertices[0] = btVector3(-1, 0, 0);
+                a.m_vertices[1] = btVector3(+1, 0, 0);
+                a.m_vertices[2] = btVector3(0, 0, -1);
+                b.m_vertices[0] = btVector3(0, -1, 1);
+                b.m_vertices[1] = btVector3(0, +1, 1);
+                b.m_vertices[2] = btVector3(0, 0, 2);
+
+                btVector3 point_on_a, point_on_b;
+                auto const distance = triangle_feature_distance(a, b, point_on_a, point_on_b);
+
+                Assert::IsTrue(std::abs(distance - 1.) < c_margin);
+                Assert::IsTrue(btVector3(0, 0, 0).distance(point_on_a) < c_margin);
+                Assert::IsTrue(btVector3(0, 0, 1).distance(point_on_b) < c_margin);
+            }
+
+            TEST_METHOD(dual_box_tree_traversal_finds_zero_distance_of_squares_touching_in_one_point)
+            {
+                auto shape_a = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_a->setMargin(c_margin);
+                shape_a->updateBound();
+
+                auto shape_b = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_b->setMargin(c_margin);
+                shape_b->updateBound();
+
+                // position p1_0 of the boost tests: a, b are coincident in a corner at {0, 0, 0}
+                btTransform transf_a(btQuaternion(0, 0, 0), btVector3(-1, -1, 0));
+                btTransform transf_b(btQuaternion(0, 0, 0), btVector3(+1, +1, 0));
+
+                box_tree_min_dist result;
+                min_dist_traverse(shape_a.get(), transf_a, shape_b.get(), transf_b, result);
+
+                Logger::WriteMessage(mstest_utils::wlog_message()
+                    << "distance: " << result.distance << std::endl
+                    << "triangle pairs: " << result.num_triangle_pairs << endl);
+
+                Assert::IsTrue(result.distance < c_margin);
+                Assert::IsTrue(result.point_on_a.distance(result.point_on_b) < c_margin);
+            }
+
+            TEST_METHOD(dual_box_tree_traversal_finds_zero_distance_of_intersecting_squares)
+            {
+                auto shape_a = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_a->setMargin(c_margin);
+                shape_a->updateBound();
+
+                auto shape_b = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_b->setMargin(c_margin);
+                shape_b->updateBound();
+
+                // position p1_1 of the boost tests: b is rotated by 90 degrees, a and b
+                // intersect along the x axis
+                btTransform transf_a(btQuaternion(0, 0, 0), btVector3(0, 0, 0));
+                btTransform transf_b(btQuaternion(0, SIMD_HALF_PI, 0), btVector3(0, 0, 0));
+
+                box_tree_min_dist result;
+                min_dist_traverse(shape_a.get(), transf_a, shape_b.get(), transf_b, result);
+
+                Logger::WriteMessage(mstest_utils::wlog_message()
+                    << "distance: " << result.distance << std::endl
+                    << "triangle pairs: " << result.num_triangle_pairs << endl);
+
+                // crossing triangles yield an exact 0 and a single contact point,
+                // not EPA's penetration witnesses:
+                Assert::IsTrue(result.distance < SIMD_EPSILON);
+                Assert::IsTrue(result.point_on_a.distance(result.point_on_b) < SIMD_EPSILON);
+
+                // the contact point lies on the line along which a and b intersect
+                Assert::IsTrue(std::abs(result.point_on_a.getY()) < c_margin);
+                Assert::IsTrue(std::abs(result.point_on_a.getZ()) < c_margin);
+                Assert::IsTrue(std::abs(result.point_on_a.getX()) <= 1. + c_margin);
+            }
+
+            TEST_METHOD(gjk_on_convex_hulls_finds_same_min_dist_as_dual_box_tree_traversal)
+            {
+                // parallel squares as in position p2 of the boost tests, b slightly shifted
+                btTransform transf_a(btQuaternion(0, 0, 0), btVector3(0, 0, +0.5));
+                btTransform transf_b(btQuaternion(0, 0, 0), btVector3(0.5, 0, -0.5));
+
+                // the convex hull of a mesh is nothing but its vertices, no triangles involved:
+                btConvexHullShape hull_a(&c_unit_square_ver[0], (int)c_unit_square_ver.size() / 3, 3 * sizeof(btScalar));
+                btConvexHullShape hull_b(&c_unit_square_ver[0], (int)c_unit_square_ver.size() / 3, 3 * sizeof(btScalar));
+                // gjk subtracts the margins from the distance, keep it exact:
+                hull_a.setMargin(0);
+                hull_b.setMargin(0);
+
+                Assert::AreEqual(4, hull_a.getNumPoints());
+
+                btScalar distance;
+                btVector3 point_on_a, point_on_b;
+                Assert::IsTrue(convex_distance(
+                    hull_a, transf_a, hull_b, transf_b, distance, point_on_a, point_on_b));
+
+                // same constellation, computed on the triangles:
+                auto shape_a = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_a->setMargin(c_margin);
+                shape_a->updateBound();
+
+                auto shape_b = std::make_unique<btGImpactMeshShape>(&c_unit_square_data);
+                shape_b->setMargin(c_margin);
+                shape_b->updateBound();
+
+                box_tree_min_dist result;
+                min_dist_traverse(shape_a.get(), transf_a, shape_b.get(), transf_b, result);
+
+                Logger::WriteMessage(mstest_utils::wlog_message()
+                    << "gjk on hulls: " << distance << std::endl
+                    << "box trees: " << result.distance
+                    << " (" << result.num_triangle_pairs << " triangle pairs)" << endl);
+
+                Assert::IsTrue(std::abs(distance - 1.) < c_margin);
+                Assert::IsTrue(std::abs(distance - result.distance) < c_margin);
+
+                // the point on b lies in the plane of b, the one on a in the plane of a
+                Assert::IsTrue(std::abs(point_on_a.getZ() - 0.5) < c_margin);
+                Assert::IsTrue(std::abs(point_on_b.getZ() + 0.5) < c_margin);
+            }
+
             struct min_dist_calculator_fixture_a_b_ {
                 cold::bullet::world world;
                 btGImpactMeshShape shape_a = &c_unit_square_data;